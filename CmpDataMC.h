@@ -26,6 +26,11 @@
 
   The significance is computed accounting for the uncertainties
   encoded in the bin "errors" of the expected histogram.
+
+  When the same canvas is passed to consecutive calls, its two pads
+  are created once and reused; everything drawn by a call is cleared
+  and deleted before it returns.  For many histograms, see
+  CmpDataMCFile() below.
  */
 
 
@@ -38,4 +43,36 @@ int CmpDataMC(TH1* hObs, // observed counts
 	      TString pdf="",     // single page PDF
 	      TCanvas* cv=0);
 
+
+
+/*
+  Batch comparison of all histogram pairs found in a ROOT file.
+
+  The directories of the file are visited recursively: each
+  one-dimensional histogram named <obsPrefix><tag> is compared with
+  the histogram <expPrefix><tag> of the same directory and drawn with
+  the stack <stackPrefix><tag>, if there is one.  The significances
+  of all pairs are computed first, by nThreads threads (0 means one
+  per hardware thread).
+
+  If summary is not empty, the pairs are drawn as by CmpDataMC() on a
+  single canvas, one page per pair of the multi-page PDF.  If output
+  is not empty, the results are written to a ROOT file without any
+  drawing, in two trees:
+
+    psde_pairs: path (observed histogram, with its directory),
+                nBins, first (entry of its first bin in psde_bins)
+    psde_bins:  pair (entry in psde_pairs), bin, p, z
+
+  The function returns the number of compared pairs.
+*/
+int CmpDataMCFile(const char* fileName,
+		  const char* summary="",     // multi-page PDF
+		  const char* output="",      // ROOT file with the p- and z-values
+		  const char* obsPrefix="data_",
+		  const char* expPrefix="mc_",
+		  const char* stackPrefix="stack_",
+		  bool neglectUncertainty=false,
+		  unsigned nThreads=0);
+
 #endif
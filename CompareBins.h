@@ -0,0 +1,48 @@
+#ifndef _PSDE_COMPAREBINS_
+#define _PSDE_COMPAREBINS_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+ */
+
+
+
+/*
+  Histogram-agnostic version of CompareHistograms(): given n bins with
+  observed counts, expected counts and the uncertainty (standard
+  deviation) of the expectation, compute the p-value and the
+  significance of each bin.
+
+  The uncertainty is taken into account when it is positive, unless
+  this is disabled (fifth parameter) or the array of uncertainties is
+  null.  The observed counts are truncated to integers, as done for
+  ROOT histograms.  The bins can be split among several threads (last
+  parameter, 0 means one per hardware thread): the output does not
+  depend on the number of threads.
+
+  CompareHistograms() shows the significance of the bins with p-value
+  smaller than 0.5 and zero for the others.
+*/
+void CompareBins(unsigned n,
+		 const double* obsCounts, // observed counts
+		 const double* expCounts, // expected counts
+		 const double* expError,  // uncertainty on expectation (or 0)
+		 bool neglectUncertainty,
+		 double* pValue,          // output p-values
+		 double* zValue,          // output significances
+		 unsigned nThreads=1);
+
+
+#endif
@@ -24,6 +24,9 @@
 #include "TH1.h"
 
 
+class THnSparse;
+
+
 
 /*
   Given two ROOT histograms (with the same binning!) containing the
@@ -41,12 +44,73 @@
   larger than 0.5: in case of ideal match, the pulls follow a standard
   normal distribution.  A typical binnin for the pulls is from -5 to
   +5 with 20 bins.
+
+  The significances can be computed by several threads (last input
+  parameter, 0 means one per hardware thread).  The histograms are
+  filled afterwards in bin order by the calling thread, hence the
+  output is the same for any number of threads.
  */
 TH1F* CompareHistograms(TH1* hObs=0,  // observed counts
 			TH1* hExp=0,  // expectation
 			bool neglectUncertainty=false,
 			bool variableBinning=false,
-			TH1* hPull=0);
+			TH1* hPull=0,
+			unsigned nThreads=1);
+
+
+
+/*
+  Significance histogram with the binning of hObs, from the p-values
+  and z-values of its bins (index i for bin i+1) already computed,
+  e.g. by CompareBins() for many histograms at once.  The pull
+  histogram is filled as by CompareHistograms().
+*/
+TH1F* SignificanceHistogram(TH1* hObs,
+			    TH1* hExp,
+			    const double* pValue,
+			    const double* zValue,
+			    bool variableBinning=false,
+			    TH1* hPull=0);
+
+
+
+/*
+  True if the two histograms have the same dimension, the same number
+  of bins and the same bin edges (within 1e-9 of the bin width) along
+  all axes
+*/
+bool CompatibleBinning(const TH1* h1, const TH1* h2);
+bool CompatibleBinning(const THnSparse* h1, const THnSparse* h2);
+
+
+
+/*
+  Same as CompareHistograms() for TH1, TH2 or TH3 histograms: the
+  output (TH1F, TH2F or TH3F) has the same binning as the input.
+
+  The bins where both the observed and the expected counts are zero
+  are skipped: they have zero significance and they are not included
+  in the pull histogram, hence the cost and the memory grow with the
+  number of populated bins.
+*/
+TH1* CompareHistogramsND(TH1* hObs,
+			 TH1* hExp,
+			 bool neglectUncertainty=false,
+			 TH1* hPull=0,
+			 unsigned nThreads=1);
+
+
+
+/*
+  Same as above for sparse histograms of any dimension: only their
+  filled bins are visited, and the output (THnSparseF) only contains
+  the bins with p-value smaller than 0.5.
+*/
+THnSparse* CompareSparseHistograms(THnSparse* hObs,
+				   THnSparse* hExp,
+				   bool neglectUncertainty=false,
+				   TH1* hPull=0,
+				   unsigned nThreads=1);
 
 
 
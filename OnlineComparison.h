@@ -0,0 +1,100 @@
+#ifndef _PSDE_ONLINECOMPARISON_
+#define _PSDE_ONLINECOMPARISON_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+ */
+
+
+#include <vector>
+
+
+
+/*
+  Bin-to-bin comparison of accumulating observed counts with a fixed
+  expectation, e.g. for the live monitoring of data quality.
+
+  The observed counts start from zero and are changed bin by bin with
+  SetObserved() or AddObserved(), which remember which bins changed.
+  Update() recomputes the p-value and the significance of those bins
+  only, and keeps their previous values until the next update, so that
+  the histograms built from them (see OnlineHistogramComparison in
+  OnlineComparisonROOT.h) can be corrected in place: the cost of an
+  update grows with the number of changed bins, not with the total.
+
+  The p-values and significances are the same as those of
+  CompareBins().  All buffers are allocated by the constructor, hence
+  neither the changes nor the updates allocate memory.
+*/
+class OnlineComparison {
+
+public:
+
+  OnlineComparison(unsigned n,
+		   const double* expCounts, // expected counts
+		   const double* expError,  // uncertainty on expectation (or 0)
+		   bool neglectUncertainty=false);
+
+  /*
+    Change the observed counts of one bin (index from 0).  As for
+    CompareBins(), the counts are truncated to integers and the bin is
+    marked as changed only if the integer changes.
+  */
+  void SetObserved(unsigned bin, double count);
+  void AddObserved(unsigned bin, double weight=1) { SetObserved(bin, fObs[bin]+weight); }
+
+  /*
+    Recompute the changed bins and return how many they are
+  */
+  unsigned Update();
+
+  /*
+    Bins recomputed by the last update, with their previous values
+    (k from 0 to GetNupdated()-1)
+  */
+  unsigned GetNupdated() const { return fUpdated.size(); }
+  unsigned GetUpdatedBin(unsigned k) const { return fUpdated[k]; }
+  double GetPreviousPValue(unsigned k) const { return fOldP[k]; }
+  double GetPreviousSignificance(unsigned k) const { return fOldZ[k]; }
+
+  /*
+    Bins changed since the last update
+  */
+  unsigned GetNchanged() const { return fChanged.size(); }
+
+  unsigned GetNbins() const { return fExp.size(); }
+  double GetObserved(unsigned bin) const { return fObs[bin]; }
+  double GetExpectation(unsigned bin) const { return fExp[bin]; }
+  double GetPValue(unsigned bin) const { return fP[bin]; }
+  double GetSignificance(unsigned bin) const { return fZ[bin]; }
+  const double* GetPValues() const { return &fP[0]; }
+  const double* GetSignificances() const { return &fZ[0]; }
+
+private:
+
+  std::vector<double> fObs, fExp, fVar; // fVar empty: Poisson
+  std::vector<double> fP, fZ;           // current results
+  std::vector<unsigned char> fIsChanged;
+  std::vector<unsigned> fChanged;       // bins changed since the update
+  std::vector<unsigned> fUpdated;       // bins of the last update
+  std::vector<double> fOldP, fOldZ;     // their previous results
+
+  // buffers of the batch computation
+  std::vector<unsigned> fBatchObs;
+  std::vector<double> fBatchExp, fBatchVar, fBatchP, fBatchZ;
+};
+
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef _PSDE_ONLINECOMPARISONROOT_
+#define _PSDE_ONLINECOMPARISONROOT_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+ */
+
+
+#include "TH1.h"
+
+#include "OnlineComparison.h"
+
+
+
+/*
+  Live comparison of an accumulating histogram with a fixed
+  expectation (see OnlineComparison.h), e.g. for data-quality
+  monitoring.
+
+  Objects are created by PrepareOnlineComparison(), which checks that
+  the two histograms have the same binning.  The significance
+  histogram (owned by this object) and the pull histogram (optional,
+  owned by the caller) are created or filled once at the preparation,
+  and then kept up to date: Update()
+  recomputes only the bins changed since the previous update, sets
+  their significance and moves their pulls from the previous bin of
+  the pull histogram to the new one.  The cost of an update grows with
+  the number of changed bins, and no memory is allocated after the
+  preparation.
+
+  The observed histogram should be filled with Fill(), which records
+  the changed bin.  If it is changed by other means, Rescan() finds
+  the changed bins by checking all of them.
+
+  The pull histogram is corrected with AddBinContent(), hence it should
+  not have Sumw2() set; its statistics are recomputed from the bin
+  contents at each update.
+*/
+class OnlineHistogramComparison {
+
+public:
+
+  ~OnlineHistogramComparison();
+
+  /*
+    Fill the observed histogram, returning the bin as TH1::Fill()
+  */
+  int Fill(double x, double w=1);
+
+  /*
+    Find the bins of the observed histogram changed without Fill(),
+    returning their number
+  */
+  unsigned Rescan();
+
+  /*
+    Recompute the changed bins and update the significance and pull
+    histograms, returning the number of recomputed bins
+  */
+  unsigned Update();
+
+  TH1* GetObserved() const { return fObs; }
+  TH1F* GetSignificance() const { return fSignificance; }
+  TH1* GetPull() const { return fPull; }
+  const OnlineComparison& GetComparison() const { return fComparison; }
+
+private:
+
+  // created by PrepareOnlineComparison(), which checks the input
+  OnlineHistogramComparison(TH1* hObs,
+			    TH1* hExp,
+			    bool neglectUncertainty,
+			    bool variableBinning,
+			    TH1* hPull);
+  friend OnlineHistogramComparison* PrepareOnlineComparison(TH1*, TH1*, bool,
+							    bool, TH1*);
+
+  OnlineHistogramComparison(const OnlineHistogramComparison&); // not copyable
+  OnlineHistogramComparison& operator=(const OnlineHistogramComparison&);
+
+  TH1* fObs;
+  TH1F* fSignificance;
+  TH1* fPull;
+  OnlineComparison fComparison;
+};
+
+
+
+/*
+  Create the live comparison of hObs with hExp (same binning, one
+  dimension), starting from the current contents of hObs.  The caller
+  owns the returned object (0 in case of invalid input).
+*/
+OnlineHistogramComparison* PrepareOnlineComparison(TH1* hObs,
+						   TH1* hExp,
+						   bool neglectUncertainty=false,
+						   bool variableBinning=false,
+						   TH1* hPull=0);
+
+
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef _PSDE_PARALLELFOR_
+#define _PSDE_PARALLELFOR_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+ */
+
+
+#include <functional>
+
+
+
+/*
+  Call body(begin,end) on consecutive chunks of the index range
+  [0,n), using nThreads threads (0 means one per hardware thread).
+
+  Each thread starts from its own contiguous share of the range and
+  takes chunks of "grain" indices from its front.  A thread which has
+  finished its share steals the back half of the largest remaining
+  share, hence the load stays balanced when the cost per index is
+  uneven.  The calling thread takes part in the work.
+
+  The body must only write to locations which depend on the indices
+  it receives: the order in which the chunks are processed is not
+  defined.
+*/
+void ParallelFor(unsigned n,
+		 const std::function<void(unsigned,unsigned)>& body,
+		 unsigned nThreads=0,
+		 unsigned grain=64);
+
+
+
+/*
+  Number of threads used by ParallelFor() when nThreads=0
+*/
+unsigned ParallelForDefaultThreads();
+
+
+#endif
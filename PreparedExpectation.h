@@ -0,0 +1,133 @@
+#ifndef _PSDE_PREPAREDEXPECTATION_
+#define _PSDE_PREPAREDEXPECTATION_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+ */
+
+
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+
+
+
+/*
+  Expectation prepared for many comparisons against different
+  observed counts, e.g. runs or pseudo-experiments compared with the
+  same background model.
+
+  For each bin the p-values are tabulated as function of the observed
+  counts, in blocks of BlockSize consecutive counts which are computed
+  the first time that a count inside them is observed: the tables
+  grow lazily up to the counts which are actually seen.  Afterwards
+  the p-value of the bin is a table lookup.
+
+  The tables are kept within a memory budget (last constructor
+  parameter, in bytes).  When it is full, the blocks which have not
+  been used recently are evicted.  If a single comparison needs more
+  blocks than the budget allows, the blocks of the remaining bins are
+  computed every time, without storing them.  The budget and
+  GetMemoryUsage() only count the table pages (BlockSize doubles per
+  block): the index of the blocks (hash map) and their bookkeeping
+  take about 60 bytes more per stored block, i.e. about 12% on top of
+  the budget, plus a few words per bin.
+
+  The tabulated p-values agree with pValuePoisson() and
+  pValuePoissonError() within 1e-11 (relative): the recurrence inside
+  a block accumulates the rounding errors of up to BlockSize terms
+  (the largest difference seen in testPreparedExpectation.C is about
+  5e-12).  The results do not depend on the order of the comparisons,
+  on the memory budget nor on the number of threads.  The object itself is not thread
+  safe: Compare() must not be called concurrently on the same object.
+*/
+class PreparedExpectation {
+
+public:
+
+  static const unsigned BlockSize = 64;  // counts per table block
+
+  PreparedExpectation(unsigned n,
+		      const double* expCounts, // expected counts
+		      const double* expError,  // uncertainty on expectation (or 0)
+		      bool neglectUncertainty=false,
+		      size_t maxBytes=64<<20); // memory budget of the tables
+
+  /*
+    Same as CompareBins(), with the expectation given at construction
+  */
+  void Compare(const double* obsCounts, // observed counts
+	       double* pValue,          // output p-values
+	       double* zValue,          // output significances
+	       unsigned nThreads=1);
+
+  /*
+    p-value of a single bin (index from 0)
+  */
+  double PValue(unsigned bin, unsigned nObs);
+
+  /*
+    Remove all tables
+  */
+  void Clear();
+
+  unsigned GetNbins() const { return fExp.size(); }
+  double GetExpectation(unsigned bin) const { return fExp[bin]; }
+  double GetVariance(unsigned bin) const { return fVar[bin]; }
+
+  size_t GetMemoryBudget() const { return fMaxSlots*BlockSize*sizeof(double); }
+  size_t GetMemoryUsage() const; // bytes of the table pages
+  unsigned long GetBlocksComputed() const { return fBlocksComputed; }
+  unsigned long GetBlocksEvicted() const { return fBlocksEvicted; }
+
+private:
+
+  PreparedExpectation(const PreparedExpectation&);            // not copyable
+  PreparedExpectation& operator=(const PreparedExpectation&);
+
+  static const unsigned NoSlot = ~0u;
+  static const unsigned SlotsPerPage = 256;
+
+  unsigned FindSlot(unsigned bin, unsigned block);
+  unsigned NewSlot(unsigned bin, unsigned block);
+  double* SlotData(unsigned slot) {
+    return &fPages[slot/SlotsPerPage][(slot%SlotsPerPage)*BlockSize];
+  }
+  void FillBlock(unsigned bin, unsigned block, double* p) const;
+  double DirectPValue(unsigned bin, unsigned nObs) const;
+
+  // expectation and ratio P(k+1)/P(k) = (fRatioA + fRatioB*k)/((k+1)*fRatioC)
+  std::vector<double> fExp, fVar;
+  std::vector<double> fRatioA, fRatioB, fRatioC;
+
+  // table blocks: slot -> (bin,block) key, last use and data pages
+  size_t fMaxSlots;
+  std::vector<unsigned long long> fSlotKey;
+  std::vector<unsigned> fSlotEpoch;
+  std::vector<unsigned char> fSlotUsed;
+  std::vector< std::vector<double> > fPages;
+  std::unordered_map<unsigned long long, unsigned> fIndex;
+  std::vector<unsigned> fLastSlot; // per bin, checked against fSlotKey
+  unsigned fClockHand;
+  unsigned fEpoch;
+
+  // buffers of Compare(), reused between calls
+  std::vector<unsigned> fObs, fBinSlot, fNewSlots;
+
+  unsigned long fBlocksComputed, fBlocksEvicted;
+};
+
+
+#endif
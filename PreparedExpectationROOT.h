@@ -0,0 +1,54 @@
+#ifndef _PSDE_PREPAREDEXPECTATIONROOT_
+#define _PSDE_PREPAREDEXPECTATIONROOT_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+ */
+
+
+#include "TH1.h"
+
+#include "PreparedExpectation.h"
+
+
+
+/*
+  Prepare the expectation for many comparisons (see
+  PreparedExpectation.h): the p-values of each bin are tabulated as
+  function of the observed counts, within the given memory budget
+  (bytes).  The caller owns the returned object.
+*/
+PreparedExpectation* PrepareExpectation(TH1* hExp,
+					bool neglectUncertainty=false,
+					size_t maxBytes=64<<20);
+
+
+
+/*
+  Same as CompareHistograms(), with the expectation prepared by
+  PrepareExpectation().  The second parameter is the histogram used
+  to prepare it, which only provides the name of the output.  After
+  the first comparisons, the p-value of each bin is a table lookup.
+*/
+TH1F* CompareHistograms(TH1* hObs,
+			TH1* hExp,
+			PreparedExpectation& expectation,
+			bool variableBinning=false,
+			TH1* hPull=0,
+			unsigned nThreads=1);
+
+
+
+#endif
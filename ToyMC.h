@@ -0,0 +1,204 @@
+#ifndef _PSDE_TOYMC_
+#define _PSDE_TOYMC_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+ */
+
+
+#include <cstddef>
+#include <vector>
+#include <mutex>
+
+
+
+/*
+  Counter-based random numbers (Philox4x32-10, Salmon et al., "Parallel
+  Random Numbers: As Easy as 1, 2, 3", SC11).  The stream is selected
+  by the key (seed) and by the stream number, without any state to be
+  shared or advanced: the numbers of a given stream are always the
+  same, whichever thread produces them.
+*/
+class ToyRandom {
+
+public:
+
+  ToyRandom(unsigned long long seed, unsigned long long stream);
+
+  unsigned Next32();           // next 32 random bits
+  double Uniform();            // uniform in (0,1), 53 bits
+  double Normal();             // standard normal
+  double Gamma(double shape);  // Gamma with unit rate
+  unsigned Poisson(double mu);
+
+  /*
+    One Philox4x32-10 block: 4 words from a 128-bit counter and a
+    64-bit key
+  */
+  static void Philox(const unsigned counter[4], const unsigned key[2],
+		     unsigned out[4]);
+
+private:
+
+  unsigned fKey[2];
+  unsigned fCounter[4]; // draw number (first two words) and stream
+  unsigned fBlock[4];
+  unsigned fUsed;       // words of fBlock already returned
+  double fNormal;       // second value of the last Box-Muller pair
+  bool fHasNormal;
+};
+
+
+
+/*
+  Fixed-binning histogram of counts, with underflow (bin 0) and
+  overflow (bin nBins+1) as in ROOT
+*/
+struct ToyHistogram {
+  unsigned nBins;
+  double xMin, xMax;
+  std::vector<unsigned long long> counts;
+
+  ToyHistogram(unsigned n=100, double lo=0, double hi=10)
+    : nBins(n), xMin(lo), xMax(hi), counts(n+2, 0) {}
+  unsigned FindBin(double x) const;
+  void Fill(double x) { ++counts[FindBin(x)]; }
+  void Add(const ToyHistogram& other);
+  void Reset() { counts.assign(counts.size(), 0); }
+  double GetBinLowEdge(unsigned bin) const { return xMin + (xMax-xMin)*(bin-1.)/nBins; }
+};
+
+
+
+/*
+  Largest |z| among the bins with p-value smaller than 0.5, i.e. the
+  most significant bin of the significance histogram produced by
+  CompareHistograms() (0 if there is none)
+*/
+double MaxAbsSignificance(unsigned n,
+			  const double* pValue,
+			  const double* zValue);
+
+
+
+/*
+  Pseudo-experiments for an expectation with n bins.
+
+  The observed counts of each pseudo-experiment are sampled from the
+  same model used for the p-values: Poisson with parameter equal to
+  the expected counts, or, when the uncertainty is taken into account,
+  Poisson with parameter sampled from the Gamma density with the
+  expectation and variance of the bin.  The counts are compared with
+  the expectation (see PreparedExpectation.h) and only aggregate
+  statistics are kept:
+
+   - the pull distribution, i.e. the z-values of all bins of all
+     pseudo-experiments (as the pull histogram of CompareHistograms());
+
+   - the distribution of the largest |z| of each pseudo-experiment;
+
+   - the number of pseudo-experiments whose largest |z| is at least
+     the one observed in the data (SetObservedMaximum()), which gives
+     the global p-value, corrected for the look-elsewhere effect.
+
+  Pseudo-experiment number k uses the random stream k of the seed,
+  hence the results do not depend on the number of threads, and
+  calling Generate() twice with N toys gives the same results as
+  calling it once with 2N toys.  Each thread works with its own
+  prepared expectation, whose tables are kept between calls; the
+  memory budget (last constructor parameter) is shared among them.
+*/
+class ToyMC {
+
+public:
+
+  ToyMC(unsigned n,
+	const double* expCounts, // expected counts
+	const double* expError,  // uncertainty on expectation (or 0)
+	bool neglectUncertainty=false,
+	unsigned long long seed=0,
+	size_t maxBytes=64<<20); // memory budget of the tables
+  ~ToyMC();
+
+  /*
+    Binning of the aggregate histograms (this resets them)
+  */
+  void SetPullBinning(unsigned nBins, double xMin, double xMax); // default 20, -5, 5
+  void SetMaxBinning(unsigned nBins, double xMax);               // default 100, 0, 10
+
+  /*
+    Largest |z| of the data, see MaxAbsSignificance().  This starts a
+    new count for the global p-value: only the pseudo-experiments
+    generated afterwards are counted (GetNcounted()), while the pull
+    and maximum distributions keep all of them.
+  */
+  void SetObservedMaximum(double zMax);
+
+  /*
+    Generate nToys more pseudo-experiments and add them to the
+    aggregate statistics (nThreads=0 means one per hardware thread)
+  */
+  void Generate(unsigned long long nToys, unsigned nThreads=1);
+
+  /*
+    Observed counts of pseudo-experiment number "toy"
+  */
+  void Sample(unsigned long long toy, double* obsCounts) const;
+
+  /*
+    Forget all pseudo-experiments: the numbering starts again from 0
+  */
+  void Reset();
+
+  unsigned GetNbins() const { return fExp.size(); }
+  unsigned long long GetNtoys() const { return fNtoys; }
+  const ToyHistogram& GetPull() const { return fPull; }
+  const ToyHistogram& GetMaxAbsZ() const { return fMaxAbsZ; }
+  double GetObservedMaximum() const { return fObservedMax; }
+  unsigned long long GetNcounted() const { return fNcounted; }
+  unsigned long long GetNexceeding() const { return fNexceeding; }
+  double GetGlobalPValue() const;      // fraction of counted toys exceeding the data
+  double GetGlobalPValueError() const; // binomial uncertainty
+
+  /*
+    Significance of the global p-value.  If no counted toy exceeds the
+    data, this is the lower bound given by p = 1/(GetNcounted()+1).
+  */
+  double GetGlobalSignificance() const;
+
+private:
+
+  ToyMC(const ToyMC&);            // not copyable
+  ToyMC& operator=(const ToyMC&);
+
+  struct Worker;
+  Worker* AcquireWorker();
+  void ReleaseWorker(Worker* w);
+
+  std::vector<double> fExp, fError, fShape, fRate;
+  bool fNeglectUncertainty;
+  unsigned long long fSeed;
+  size_t fMaxBytes;
+
+  std::vector<Worker*> fWorkers, fFreeWorkers;
+  std::mutex fMutex;
+
+  unsigned long long fNtoys, fNcounted, fNexceeding;
+  double fObservedMax;
+  ToyHistogram fPull, fMaxAbsZ;
+};
+
+
+#endif
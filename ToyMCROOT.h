@@ -0,0 +1,50 @@
+#ifndef _PSDE_TOYMCROOT_
+#define _PSDE_TOYMCROOT_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+ */
+
+
+#include "TH1.h"
+
+#include "ToyMC.h"
+
+
+
+/*
+  Pseudo-experiments for the expectation (see ToyMC.h): the observed
+  counts are sampled from the Poisson or Poisson-Gamma model of each
+  bin, and only aggregate statistics are kept.  The caller owns the
+  returned object.
+*/
+ToyMC* PrepareToyMC(TH1* hExp,
+		    bool neglectUncertainty=false,
+		    unsigned long long seed=0,
+		    size_t maxBytes=64<<20);
+
+
+
+/*
+  ROOT histogram with the contents of an aggregate histogram of the
+  pseudo-experiments (pull or largest |z|)
+*/
+TH1F* ToyHistogramToTH1(const ToyHistogram& h,
+			const char* name,
+			const char* title="");
+
+
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef _PSDE_PVALUEBATCH_
+#define _PSDE_PVALUEBATCH_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+
+  -----------------------------------------------------------------
+
+  Batch versions of the functions in pValuePoissonError.h, working
+  on contiguous arrays of bins instead of one bin per call.  All
+  arrays have (at least) n elements.
+ */
+
+
+
+/*
+  p-values for n bins.  The uncertainty on the expectation is taken
+  into account when the variance is positive, otherwise (or when the
+  array of variances is null) the Poisson p-value is computed.
+*/
+void pValueBatch(unsigned n,
+		 const unsigned* nObs, // observed counts
+		 const double* E,      // expected counts
+		 const double* V,      // variance of expectation (or 0)
+		 double* pValue);      // output p-values
+
+
+
+/*
+  Normal quantile for n probabilities, using the same rational
+  approximation of pja_normal_quantile() in double precision.  The
+  computation is vectorized with AVX-512 or AVX2 instructions, when
+  they are supported by the CPU (checked at run time), otherwise the
+  scalar version is used.  As the scalar function, it returns 0 when
+  the probability is not inside (0,1).  Subnormal probabilities are
+  handled as the normal ones by every kernel.  The vectorized kernels
+  use FMA and their own logarithm, hence they are not bit-for-bit
+  identical to the scalar one: they agree within 16 ulp in the tails
+  and within 8192 ulp (2e-12 relative) in the central region, whose
+  polynomial cancels, far below the 1e-9 accuracy of the approximation
+  itself (checked by testPValueBatch.C).
+*/
+void normalQuantileBatch(unsigned n,
+			 const double* p, // probabilities
+			 double* x);      // output quantiles
+
+
+
+/*
+  Convert n p-values into significances, as pValueToSignificance().
+  The bin is an excess when nObs>E.  For an excess, the significance
+  is computed as minus the quantile of p rather than the quantile of
+  1-p, which is the same thing without losing precision when p is
+  tiny.
+*/
+void pValueToSignificanceBatch(unsigned n,
+			       const double* pValue,
+			       const unsigned* nObs, // observed counts
+			       const double* E,      // expected counts
+			       double* zValue);      // output significances
+
+
+
+/*
+  p-values and significances for n bins in one call
+*/
+void significanceBatch(unsigned n,
+		       const unsigned* nObs, // observed counts
+		       const double* E,      // expected counts
+		       const double* V,      // variance of expectation (or 0)
+		       double* pValue,       // output p-values
+		       double* zValue);      // output significances
+
+
+
+/*
+  Name of the normal quantile kernel selected at run time:
+  "avx512", "avx2" or "scalar"
+*/
+const char* normalQuantileBatchKernel();
+
+
+
+/*
+  Same as normalQuantileBatch() with the given kernel ("avx512",
+  "avx2" or "scalar") instead of the one selected at run time, e.g.
+  to compare or time them.  It returns false, computing nothing, when
+  the kernel is not compiled or not supported by the CPU.
+*/
+bool normalQuantileBatchUsing(const char* kernel,
+			      unsigned n,
+			      const double* p, // probabilities
+			      double* x);      // output quantiles
+
+
+#endif
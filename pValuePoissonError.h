@@ -40,6 +40,46 @@ double pValuePoissonError(unsigned nObs, // observed counts
 			  double V=1);   // variance of expectation
 
 
+/*
+  Same as above, computed by summing the terms of the marginal model
+  one by one (slower reference implementation, whose cost grows with
+  nObs)
+*/
+double pValuePoissonErrorRecurrence(unsigned nObs, // observed counts
+				    double E=1,    // expected counts
+				    double V=1);   // variance of expectation
+
+
+
+/*
+  Probability of observing n counts, without and with uncertainty on
+  the expectation: the terms summed by the p-values above
+*/
+double probPoisson(unsigned n,       // observed counts
+		   double nExp);     // Poisson parameter
+
+double probPoissonError(unsigned n,  // observed counts
+			double E=1,  // expected counts
+			double V=1); // variance of expectation
+
+
+
+/*
+  Error term of Stirling's formula, log(x!) - [(x+1/2) log(x) - x +
+  log(2pi)/2], for log(k!) where lgamma cannot be used because it
+  writes the global signgam and is not thread safe
+*/
+double psde_stirlerr(double x);
+
+
+
+/*
+  Normal quantile (inverse of the standard normal cumulative
+  distribution), with relative error smaller than 1.15e-9
+*/
+double pja_normal_quantile(long double p);
+
+
 
 /*
   Convert a p-value into a right-tail normal significance, i.e. into
@@ -0,0 +1,38 @@
+#ifndef _PSDE_TESTHELPERS_
+#define _PSDE_TESTHELPERS_
+
+/*
+  Code from
+  "Plotting the Differences Between Data and Expectation"
+  by Georgios Choudalakis and Diego Casadei
+  Eur. Phys. J. Plus 127 (2012) 25
+  http://dx.doi.org/10.1140/epjp/i2012-12025-y
+  (http://arxiv.org/abs/1111.2062)
+
+  -----------------------------------------------------------------
+  This code is covered by the GNU General Public License:
+  http://www.gnu.org/licenses/gpl.html
+  -----------------------------------------------------------------
+
+  $Id$
+
+  -----------------------------------------------------------------
+
+  Helpers shared by the test macros (not part of the libraries).
+ */
+
+
+
+/*
+  Uniform number in [0,1) from a linear congruential generator, whose
+  state is updated.  The tests use it for deterministic bin contents,
+  which do not depend on ROOT nor on the standard library.
+*/
+inline double psde_test_uniform(unsigned& seed)
+{
+  seed = 1664525*seed + 1013904223;
+  return (seed>>8) / 16777216.;
+}
+
+
+#endif